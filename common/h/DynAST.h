@@ -192,6 +192,8 @@ class COMMON_EXPORT AST : public boost::enable_shared_from_this<AST> {
   virtual ~AST() {};
   
   bool operator==(const AST &rhs) const {
+    // Shared (e.g., hash-consed) subtrees compare equal without a walk
+    if (this == &rhs) return true;
     // make sure rhs and this have the same type
     return((typeid(*this) == typeid(rhs)) && isStrictEqual(rhs));
   }
@@ -202,6 +202,7 @@
 #define __UTIL_H__
 
 #include <string>
+#include <vector>
 #include "dyntypes.h"
 
 #if defined(_MSC_VER)
@@ -228,6 +229,15 @@ COMMON_EXPORT std::string utos(unsigned);
 
 COMMON_EXPORT bool wildcardEquiv(const std::string &us, const std::string &them, bool checkCase = false );
 
+// Literal substrings that every string matched by a pattern has to
+// contain.  Checking for them is much cheaper than running the matcher,
+// so searches over many names use them to rule out most candidates first.
+// regexLiterals returns false if it can't tell (e.g, top-level alternation).
+COMMON_EXPORT void wildcardLiterals(const std::string &pattern, std::vector<std::string> &lits);
+COMMON_EXPORT bool regexLiterals(const char *pattern, std::vector<std::string> &lits);
+COMMON_EXPORT bool containsLiterals(const std::string &s, const std::vector<std::string> &lits,
+                                    bool checkCase = true);
+
 const char *platform_string();
 }
 
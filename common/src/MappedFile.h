@@ -36,9 +36,16 @@
 #include "Types.h"
 
 class MappedFile {
-     static dyn_hash_map<std::string, MappedFile *> mapped_files;
-
    public:
+      // How a range of the file is about to be read; see adviseRange
+      typedef enum {
+         access_normal,
+         access_sequential,
+         access_random,
+         access_willneed
+      } access_pattern_t;
+
+
       COMMON_EXPORT static MappedFile *createMappedFile(std::string fullpath_);
       COMMON_EXPORT static MappedFile *createMappedFile(void *map_loc, unsigned long size_, const std::string &name);
       COMMON_EXPORT static void closeMappedFile(MappedFile *&mf);
@@ -52,7 +59,12 @@ class MappedFile {
       COMMON_EXPORT int getFD() {return fd;}
 #endif
       COMMON_EXPORT unsigned long size() {return file_size;}
-      COMMON_EXPORT MappedFile *clone() { refCount++; return this; }
+      COMMON_EXPORT MappedFile *clone();
+
+      // Pass an access hint for [offset, offset+length) to the kernel.
+      // Only applies to files this object mapped itself.
+      COMMON_EXPORT bool adviseRange(unsigned long offset, unsigned long length,
+                                     access_pattern_t pattern);
 
       COMMON_EXPORT void setSharing(bool s);
       COMMON_EXPORT bool canBeShared();
@@ -56,6 +56,14 @@ class ABI{
 
     DATAFLOW_EXPORT const bitArray &getAllRegs() const;
 
+    // Fixed-width copies of the summaries above, for dataflow that
+    // must not allocate per block.
+    DATAFLOW_EXPORT const registerSet &getCallReadRegisterSet() const { return callReadSet_; }
+    DATAFLOW_EXPORT const registerSet &getCallWrittenRegisterSet() const { return callWrittenSet_; }
+    DATAFLOW_EXPORT const registerSet &getReturnReadRegisterSet() const { return returnReadSet_; }
+    DATAFLOW_EXPORT const registerSet &getSyscallReadRegisterSet() const { return syscallReadSet_; }
+    DATAFLOW_EXPORT const registerSet &getSyscallWrittenRegisterSet() const { return syscallWrittenSet_; }
+
     DATAFLOW_EXPORT int getIndex(MachRegister machReg);
     DATAFLOW_EXPORT std::map<MachRegister,int>* getIndexMap();
 
@@ -64,6 +72,7 @@ class ABI{
 
     DATAFLOW_EXPORT static ABI* getABI(int addr_width);
     DATAFLOW_EXPORT bitArray getBitArray();
+    DATAFLOW_EXPORT registerSet getRegisterSet();
  private:
     static dyn_tls bitArray* callRead_;
     static dyn_tls bitArray* callRead64_;
@@ -93,6 +102,13 @@ class ABI{
         return new bitArray(size);
     }
 
+    registerSet callReadSet_;
+    registerSet callWrittenSet_;
+    registerSet returnReadSet_;
+    registerSet syscallReadSet_;
+    registerSet syscallWrittenSet_;
+    void initRegisterSets();
+
     ABI(): index(NULL), addr_width(0) {}
 };
 
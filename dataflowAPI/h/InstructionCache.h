@@ -41,8 +41,8 @@ using namespace Dyninst;
 
 struct ReadWriteInfo
 {
-  bitArray read;
-  bitArray written;
+  registerSet read;
+  registerSet written;
   int insnSize;
 };
 
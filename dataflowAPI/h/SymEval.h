@@ -355,6 +355,11 @@ public:
   // prior results from the Graph
   // are substituted into anything that uses them.
   DATAFLOW_EXPORT static Retval_t expand(Dyninst::Graph::Ptr slice, DataflowAPI::Result_t &res);
+
+  // Expansions of individual instructions are memoized across calls, up
+  // to a fixed number of them; these report how many are held and the limit.
+  DATAFLOW_EXPORT static size_t expansionCacheSize();
+  DATAFLOW_EXPORT static size_t expansionCacheCapacity();
   
  private:
 
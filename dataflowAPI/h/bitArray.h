@@ -33,8 +33,148 @@
 #ifndef _BITARRAY_
 #define _BITARRAY_
 #include <boost/dynamic_bitset.hpp>
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <ostream>
 typedef boost::dynamic_bitset<unsigned long, std::allocator<unsigned long> > bitArray;
 
+// Fixed-capacity bit set for per-block register dataflow. Storage is an
+// inline array of 64-bit words, so copies never touch the heap, and every
+// set operation is a loop with a compile-time trip count that the compiler
+// turns into vector instructions for the target. The logical size mirrors
+// bitArray::size() so the two convert losslessly; bits at or beyond the
+// logical size are always kept clear.
+template <unsigned Bits>
+class fixedBitArray {
+   typedef uint64_t word_t;
+   static const unsigned WordBits = 64;
+   static const unsigned Words = Bits / WordBits;
+   static_assert(Bits % 64 == 0 && Bits > 0,
+                 "fixedBitArray capacity must be a positive multiple of 64");
+
+   word_t w_[Words];
+   size_t size_;
+
+   static word_t bitMask(size_t i) { return word_t(1) << (i % WordBits); }
+
+   void trim() {
+      for (unsigned i = 0; i < Words; ++i) {
+         size_t lo = size_t(i) * WordBits;
+         if (lo >= size_) w_[i] = 0;
+         else if (size_ - lo < WordBits) w_[i] &= (word_t(1) << (size_ - lo)) - 1;
+      }
+   }
+
+ public:
+   class reference {
+      friend class fixedBitArray;
+      word_t &word_;
+      word_t mask_;
+      reference(word_t &word, word_t mask) : word_(word), mask_(mask) {}
+    public:
+      operator bool() const { return (word_ & mask_) != 0; }
+      reference &operator=(bool v) {
+         if (v) word_ |= mask_; else word_ &= ~mask_;
+         return *this;
+      }
+      reference &operator=(const reference &r) { return *this = bool(r); }
+   };
+
+   fixedBitArray() : size_(0) { reset(); }
+   explicit fixedBitArray(size_t n) : size_(n) {
+      assert(n <= Bits);
+      reset();
+   }
+   explicit fixedBitArray(const bitArray &b) : size_(b.size()) {
+      assert(b.size() <= Bits);
+      reset();
+      for (size_t i = b.find_first(); i != bitArray::npos; i = b.find_next(i))
+         w_[i / WordBits] |= bitMask(i);
+   }
+
+   static unsigned capacity() { return Bits; }
+   size_t size() const { return size_; }
+   bool empty() const { return size_ == 0; }
+
+   bool test(size_t i) const {
+      assert(i < size_);
+      return (w_[i / WordBits] & bitMask(i)) != 0;
+   }
+   bool operator[](size_t i) const { return test(i); }
+   reference operator[](size_t i) {
+      assert(i < size_);
+      return reference(w_[i / WordBits], bitMask(i));
+   }
+   fixedBitArray &set(size_t i, bool v = true) {
+      (*this)[i] = v;
+      return *this;
+   }
+   fixedBitArray &reset() {
+      for (unsigned i = 0; i < Words; ++i) w_[i] = 0;
+      return *this;
+   }
+
+   bool any() const {
+      word_t acc = 0;
+      for (unsigned i = 0; i < Words; ++i) acc |= w_[i];
+      return acc != 0;
+   }
+   bool none() const { return !any(); }
+
+   fixedBitArray &operator|=(const fixedBitArray &rhs) {
+      for (unsigned i = 0; i < Words; ++i) w_[i] |= rhs.w_[i];
+      if (rhs.size_ > size_) size_ = rhs.size_;
+      return *this;
+   }
+   fixedBitArray &operator&=(const fixedBitArray &rhs) {
+      for (unsigned i = 0; i < Words; ++i) w_[i] &= rhs.w_[i];
+      if (rhs.size_ > size_) size_ = rhs.size_;
+      return *this;
+   }
+   fixedBitArray &operator-=(const fixedBitArray &rhs) {
+      for (unsigned i = 0; i < Words; ++i) w_[i] &= ~rhs.w_[i];
+      if (rhs.size_ > size_) size_ = rhs.size_;
+      return *this;
+   }
+   fixedBitArray operator~() const {
+      fixedBitArray ret(*this);
+      for (unsigned i = 0; i < Words; ++i) ret.w_[i] = ~w_[i];
+      ret.trim();
+      return ret;
+   }
+   fixedBitArray operator|(const fixedBitArray &rhs) const { return fixedBitArray(*this) |= rhs; }
+   fixedBitArray operator&(const fixedBitArray &rhs) const { return fixedBitArray(*this) &= rhs; }
+   fixedBitArray operator-(const fixedBitArray &rhs) const { return fixedBitArray(*this) -= rhs; }
+
+   bool operator==(const fixedBitArray &rhs) const {
+      if (size_ != rhs.size_) return false;
+      word_t diff = 0;
+      for (unsigned i = 0; i < Words; ++i) diff |= w_[i] ^ rhs.w_[i];
+      return diff == 0;
+   }
+   bool operator!=(const fixedBitArray &rhs) const { return !(*this == rhs); }
+
+   bitArray toBitArray() const {
+      bitArray ret(size_);
+      for (size_t i = 0; i < size_; ++i)
+         if (w_[i / WordBits] & bitMask(i)) ret[i] = true;
+      return ret;
+   }
+};
+
+// Same textual form as bitArray: most significant bit first.
+template <unsigned Bits>
+std::ostream &operator<<(std::ostream &os, const fixedBitArray<Bits> &b) {
+   for (size_t i = b.size(); i > 0; --i)
+      os << (b.test(i - 1) ? '1' : '0');
+   return os;
+}
+
+// Every ABI register index map fits in this many bits; ABI asserts it.
+#define REGISTER_SET_BITS 256
+typedef fixedBitArray<REGISTER_SET_BITS> registerSet;
+
 // Bitarrays for register liveness. This could move to registerSpace...
 #define SPEC_GPR_BIT(x) (x.size() - 3)
 #define SPEC_FPR_BIT(x) (x.size() - 2)
@@ -47,22 +47,23 @@
 using namespace Dyninst;
 using namespace Dyninst::InstructionAPI;
 
+// Per-block sets are fixed width so the fixpoint never allocates.
 struct livenessData{
-	bitArray in, out, use, def;
+	registerSet in, out, use, def;
 };
 
 class DATAFLOW_EXPORT LivenessAnalyzer{
 	std::map<ParseAPI::Block*, livenessData> blockLiveInfo;
 	std::map<ParseAPI::Function*, bool> liveFuncCalculated;
-        std::map<ParseAPI::Function*, bitArray> funcRegsDefined;
+        std::map<ParseAPI::Function*, registerSet> funcRegsDefined;
 	InstructionCache cachedLivenessInfo;
 
-	const bitArray& getLivenessIn(ParseAPI::Block *block);
-	const bitArray& getLivenessOut(ParseAPI::Block *block, bitArray &allRegsDefined);
-	void processEdgeLiveness(ParseAPI::Edge* e, livenessData& data, ParseAPI::Block* block, const bitArray& allRegsDefined);
+	const registerSet& getLivenessIn(ParseAPI::Block *block);
+	const registerSet& getLivenessOut(ParseAPI::Block *block, registerSet &allRegsDefined);
+	void processEdgeLiveness(ParseAPI::Edge* e, livenessData& data, ParseAPI::Block* block, const registerSet& allRegsDefined);
 	
-	void summarizeBlockLivenessInfo(ParseAPI::Function* func, ParseAPI::Block *block, bitArray &allRegsDefined);
-	bool updateBlockLivenessInfo(ParseAPI::Block *block, bitArray &allRegsDefined);
+	void summarizeBlockLivenessInfo(ParseAPI::Function* func, ParseAPI::Block *block, registerSet &allRegsDefined);
+	bool updateBlockLivenessInfo(ParseAPI::Block *block, registerSet &allRegsDefined);
 	
 	ReadWriteInfo calcRWSets(Instruction curInsn, ParseAPI::Block *blk, Address a);
 
@@ -81,8 +82,8 @@ public:
 
 	template <class OutputIterator>
 	bool query(ParseAPI::Location loc, Type type, OutputIterator outIter){
-		bitArray liveRegs;
-		if (query(loc,type, liveRegs)){
+		registerSet liveRegs;
+		if (queryInternal(loc,type, liveRegs)){
 			for (std::map<MachRegister,int>::const_iterator iter = abi->getIndexMap()->begin(); iter != abi->getIndexMap()->end(); ++iter)
 				if (liveRegs[iter->second]){
 					outIter = iter->first;
@@ -104,6 +105,7 @@ public:
 	ABI* getABI() { return abi;}
 
 private:
+	bool queryInternal(ParseAPI::Location loc, Type type, registerSet &liveRegs);
 	ErrorType errorno;
 };
 
@@ -142,6 +142,10 @@ class Slicer {
   // The cache is keyed with basic block starting address.
   typedef dyn_hash_map<Address, InsnVec> InsnCache;
 
+  // Slicing state that can be kept between slices of one function;
+  // see below.
+  class SliceContext;
+
   DATAFLOW_EXPORT Slicer(AssignmentPtr a,
 	 ParseAPI::Block *block,
 	 ParseAPI::Function *func,
@@ -159,6 +163,11 @@ class Slicer {
           AssignmentConverter *ac,
           InsnCache *c);
 
+  DATAFLOW_EXPORT Slicer(AssignmentPtr a,
+          ParseAPI::Block *block,
+          ParseAPI::Function *func,
+          SliceContext *ctx);
+
 
   DATAFLOW_EXPORT ~Slicer();
     
@@ -456,6 +465,51 @@ class Slicer {
     
     };
 
+ public:
+  /*
+   * Everything a backward slice learns about a function that another
+   * backward slice of the same function can reuse: decoded instructions,
+   * the assignments they convert to, the definitions cached below each
+   * visited point, and the def-use edges found so far. When a slice
+   * reaches an edge an earlier slice already searched past, it links the
+   * cached definitions and copies the sub-slice behind them instead of
+   * searching again.
+   *
+   * Slices sharing a context must use equivalent predicates. The context
+   * resets itself if the function's blocks change; call invalidate() after
+   * any other change that affects slicing. Not thread-safe.
+   */
+  class SliceContext {
+    friend class Slicer;
+   public:
+    DATAFLOW_EXPORT SliceContext(ParseAPI::Function *f,
+                                 bool stackAnalysis = true);
+    DATAFLOW_EXPORT void invalidate();
+
+   private:
+    // Resets the context if the CFG of func has changed since it was filled
+    void validate();
+    size_t cfgSignature() const;
+
+    ParseAPI::Function *func;
+    bool stackAnalysis_;
+    size_t signature;
+
+    InsnCache insnCache;
+    AssignmentConverter converter;
+
+    std::map<CacheEdge, std::set<AbsRegion> > visited;
+    std::unordered_map<Address, DefCache> singleCache;
+    std::unordered_map<Address, DefCache> cache;
+
+    // Def-use edges of earlier slices, keyed by the use
+    std::map<AssignmentPtr, std::set<Def> > deps;
+    std::set<AssignmentPtr> entries;
+    std::set<AssignmentPtr> widened;
+  };
+
+ private:
+
     // For preventing insertion of duplicate edges
     // into the slice graph
     struct EdgeTuple {
@@ -710,9 +764,16 @@ private:
 
   void mergeRecursiveCaches(std::unordered_map<Address, DefCache>& sc, std::unordered_map<Address, DefCache>& c, Address a);
 
+  void linkFromContext(GraphPtr g, SliceFrame &f, DefCache &cache);
+  void importSubSlice(GraphPtr g, Element const& start);
+
   InsnCache* insnCache_;
   bool own_insnCache;
 
+  SliceContext *context_;
+  // Assignments whose sub-slice has been copied from context_
+  std::set<AssignmentPtr> imported_;
+
   AssignmentPtr a_;
   ParseAPI::Block *b_;
   ParseAPI::Function *f_;
@@ -39,6 +39,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 // To define StackAST
 #include "DynAST.h"
@@ -62,6 +63,7 @@
 // These are _NOT_ in the Dyninst namespace...
 namespace Dyninst {
    namespace ParseAPI {
+      class CodeObject;
       class Function;
       class Block;
       class Edge;
@@ -515,6 +517,28 @@ public:
    DATAFLOW_EXPORT bool canGetFunctionSummary();
    DATAFLOW_EXPORT bool getFunctionSummary(TransferSet &summary);
 
+   // Analyzes every function in the CodeObject, callees before callers,
+   // with functions that do not depend on each other analyzed in parallel.
+   // Callee summaries are applied at call sites; the summaries computed are
+   // returned keyed by function entry. Results replace the functions'
+   // annotations, so later queries on any StackAnalysis of these functions
+   // reuse them; existing annotations are updated in place rather than
+   // reallocated, so analyses that already hold them stay valid.
+   DATAFLOW_EXPORT static void analyzeAll(ParseAPI::CodeObject *co,
+      std::map<Address, TransferSet> &summaries);
+
+   // A location whose height findBatch should look up
+   struct Query {
+      ParseAPI::Function *func;
+      ParseAPI::Block *block;
+      Address addr;
+      Absloc loc;
+   };
+
+   // Like find, for many locations at once; heights[i] answers queries[i]
+   DATAFLOW_EXPORT static void findBatch(const std::vector<Query> &queries,
+      std::vector<Height> &heights);
+
    DATAFLOW_EXPORT void debug();
 
 private:
@@ -534,6 +558,17 @@ private:
 
    void createIntervals();
 
+   AbslocState &intervalAt(ParseAPI::Block *b, Offset off);
+   const AbslocState *findExactInterval(ParseAPI::Block *b, Address addr);
+
+   // Used by analyzeAll: compute effects and intervals without reading
+   // the function's annotations, then install the results as its new
+   // annotations.
+   void buildInsnEffects();
+   void buildIntervals();
+   void publishAnnotations();
+   void discardResults();
+
    void createEntryInput(AbslocState &input);
    void createSummaryEntryInput(TransferSet &input);
    void meetInputs(ParseAPI::Block *b, AbslocState& blockInput,
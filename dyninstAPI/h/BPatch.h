@@ -291,6 +291,10 @@ public:
     // returns whether trampolines are set to handle recursive instrumentation
     bool isTrampRecursive();
 
+    // BPatch::isSwitchableInstrumentation:
+    // returns whether new base tramps can be switched on and off in place
+    bool isSwitchableInstrumentation();
+
     // BPatch::isMergeTramp:
     // returns whether base tramp and mini-tramp is merged
     bool isMergeTramp();        
@@ -490,6 +494,15 @@ public:
 
     void setTrampRecursive(bool x);
 
+    //  BPatch::setSwitchableInstrumentation:
+    //  Turn on/off switchable base tramps. Points instrumented while this
+    //  is on start with a branch that BPatch_point::setInstrumentationEnabled
+    //  can overwrite, and also consult the runtime library's
+    //  DYNINST_inst_disabled map. Only applies to dynamic processes.
+
+
+    void setSwitchableInstrumentation(bool x);
+
     //  BPatch::setMergeTramp:
     //  Turn on/off merged base & mini-tramps
     
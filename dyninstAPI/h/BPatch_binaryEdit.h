@@ -104,6 +104,20 @@ class BPATCH_DLL_EXPORT BPatch_binaryEdit : public BPatch_addressSpace {
     // BPatch_binaryEdit::writeFile
     bool writeFile(const char * outFile);
 
+    // BPatch_binaryEdit::setTrapFreeSpringboards
+    //
+    //  If true, springboards that do not fit as a direct branch are placed
+    //  through function padding or a chain of short branches through dead
+    //  relocated code before falling back to a trap. Any traps that remain
+    //  are reported when the file is written.
+    void setTrapFreeSpringboards(bool b);
+
+    // BPatch_binaryEdit::getTrapSites
+    //
+    //  Returns the original addresses that received trap-based springboards,
+    //  paired with the name of the object that contains them
+    void getTrapSites(std::vector<std::pair<std::string, Dyninst::Address> > &sites);
+
   
     //  BPatch_binaryEdit::~BPatch_binaryEdit
     //
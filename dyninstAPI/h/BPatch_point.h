@@ -288,6 +288,22 @@ public:
 
 
     bool usesTrap_NP();
+
+    //  BPatch_point::setInstrumentationEnabled
+    //  Switch all snippets at this point on or off without relocating.
+    //  Only possible for points instrumented while switchable
+    //  instrumentation was on (see BPatch::setSwitchableInstrumentation);
+    //  returns false otherwise.
+
+
+    bool setInstrumentationEnabled(bool enabled);
+
+    //  BPatch_point::getInstrumentationSwitch
+    //  Returns this point's index into the runtime library's
+    //  DYNINST_inst_disabled map, or -1 if it does not have one.
+
+
+    int getInstrumentationSwitch();
 };
 
 #endif /* _BPatch_point_h_ */
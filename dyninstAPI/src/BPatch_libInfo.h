@@ -42,7 +42,13 @@
 class BPatch_libInfo {
 public:
    std::unordered_map<int, BPatch_process *> procsByPid;
+
+   // See BPatch::setSwitchableInstrumentation; kept here rather than in
+   // BPatch to leave that class's layout alone.
+   bool switchableInstOn;
+
    BPatch_libInfo() : 
+       switchableInstOn(false),
        stopThreadIDCounter_(0)
     {}
 
@@ -195,6 +195,15 @@ class SpringboardBuilder;
                                            fromRelocatedCode, useTrap);
    }
 
+   // Does any request, at any priority, originate within [start, end)?
+   bool hasSource(Address start, Address end) const {
+      for (Springboards::const_iterator p = sBoardMap_.begin(); p != sBoardMap_.end(); ++p) {
+         const_iterator s = p->second.lower_bound(start);
+         if (s != p->second.end() && s->first < end) return true;
+      }
+      return false;
+   }
+
    iterator begin(Priority p) { return sBoardMap_[p].begin(); };
    iterator end(Priority p) { return sBoardMap_[p].end(); };
 
@@ -225,7 +234,7 @@ class InstalledSpringboards
   typedef boost::shared_ptr<InstalledSpringboards> Ptr;
   static const int Allocated;
   static const int UnallocatedStart;
- InstalledSpringboards() {}
+ InstalledSpringboards() : usePadding_(false) {}
   
   
 
@@ -234,6 +243,8 @@ class InstalledSpringboards
   bool addFunc(func_instance* f);
   bool conflict(Address start, Address end, bool inRelocatedCode, func_instance* func, Priority p);
   bool conflictInRelocated(Address start, Address end);
+  // Does [start, end) overlap a springboard that is already installed?
+  bool allocated(Address start, Address end);
 
   void registerBranch(Address start, Address end, const SpringboardReq::Destinations &dest, bool inRelocatedCode, func_instance* func, Priority p);
   void registerBranchInRelocated(Address start, Address end, func_instance* func, Priority p);
@@ -242,6 +253,9 @@ class InstalledSpringboards
     return relocTraps_.find(a) != relocTraps_.end();
   }
 
+  // Claim unparsed NOP padding after blocks when adding functions
+  void setUsePadding(bool b) { usePadding_ = b; }
+
     
   
  private:
@@ -258,6 +272,7 @@ class InstalledSpringboards
   // padding may not exist in the relocation buffer.  Remember such ranges so
   // we can deal with that in reinstrumentation, if only to force a trap.
   IntervalTree<Address, SpringboardInfo*> paddingRanges_;
+  bool usePadding_;
 
   // Like the previous, but for branches we put in relocated code. We
   // assume anything marked as "in relocated code" is a valid thing to write
@@ -285,6 +300,21 @@ class SpringboardBuilder {
   bool generate(std::list<codeGen> &springboards,
 		SpringboardMap &input);
 
+  // Traps and branches this builder registered with the address space,
+  // kept so a cached relocation can register them again when reinstalled
+  struct RegisteredBranch {
+    Address start;
+    Address end;
+    SpringboardReq::Destinations dest;
+    bool inRelocatedCode;
+    func_instance *func;
+    Priority p;
+  };
+  typedef std::vector<std::pair<Address, Address> > Traps;
+  typedef std::vector<RegisteredBranch> Branches;
+  const Traps &traps() const { return traps_; }
+  const Branches &branches() const { return branches_; }
+
  private:
   SpringboardBuilder(AddressSpace *a);
 
@@ -299,6 +329,11 @@ class SpringboardBuilder {
   bool generateMultiSpringboard(std::list<codeGen> &input,
 				const SpringboardReq &p);
 
+  // Short branch to a free slot nearby that holds the full branch
+  bool generateChainedSpringboard(std::list<codeGen> &input,
+                                  const SpringboardReq &p,
+                                  SpringboardMap &);
+
   // Find all previous instrumentations and also overwrite 
   // them. 
   bool createRelocSpringboards(const SpringboardReq &r, bool useTrap, SpringboardMap &input);
@@ -317,6 +352,8 @@ class SpringboardBuilder {
 
   void registerBranch(Address start, Address end, const SpringboardReq::Destinations &dest, bool inRelocatedCode, func_instance* func, Priority p)
   {
+    RegisteredBranch b = { start, end, dest, inRelocatedCode, func, p };
+    branches_.push_back(b);
     return installed_springboards_->registerBranch(start, end, dest, inRelocatedCode, func, p);
   }
 
@@ -330,6 +367,12 @@ class SpringboardBuilder {
   
   std::list<SpringboardReq> multis_;
 
+  Traps traps_;
+  Branches branches_;
+
+  // Binary rewriting with trap-free springboard placement
+  bool trapFree_;
+
 };
 
 };
@@ -357,6 +357,12 @@ class AddressSpace : public InstructionSource {
     int_variable* trampGuardBase(void) { return trampGuardBase_; }
     AstNodePtr trampGuardAST(void);
 
+    // Switchable instrumentation: the address of a tramp's entry in the
+    // runtime library's DYNINST_inst_disabled map (0 if unavailable), and
+    // in-place toggling of every relocated copy of a tramp.
+    Address getInstSwitchAddr(baseTramp *bt);
+    bool setInstrumentationEnabled(instPoint *point, bool enabled);
+
     // Get the current code generator (or emitter)
     Emitter *getEmitter();
 
@@ -514,6 +520,9 @@ class AddressSpace : public InstructionSource {
     int_variable* trampGuardBase_; // Tramp recursion index mapping
     AstNodePtr trampGuardAST_;
 
+    Address instSwitchBase_;
+    int nextInstSwitch_;
+
     void *up_ptr_;
 
     Address costAddr_;
@@ -522,15 +531,50 @@ class AddressSpace : public InstructionSource {
     typedef std::list<Relocation::CodeTracker *> CodeTrackers;
     CodeTrackers relocatedCode_;
 
+    typedef std::vector<std::pair<Address, std::vector<unsigned char> > > SavedPatches;
+
     bool transform(Dyninst::Relocation::CodeMoverPtr cm);
     Address generateCode(Dyninst::Relocation::CodeMoverPtr cm, Address near);
     bool patchCode(Dyninst::Relocation::CodeMoverPtr cm,
-		   Dyninst::Relocation::SpringboardBuilderPtr spb);
+		   Dyninst::Relocation::SpringboardBuilderPtr spb,
+		   SavedPatches *saved = NULL);
 
     typedef std::set<func_instance *> FuncSet;
     std::map<mapped_object *, FuncSet> modifiedFunctions_;
 
     bool relocateInt(FuncSet::const_iterator begin, FuncSet::const_iterator end, Address near);
+    void redirectActiveFrames();
+    void redirectAllFrames(Relocation::CodeTracker *target);
+    bool mapIntoRelocation(Address pc, func_instance *hint,
+                           Relocation::CodeTracker *target, Address &newPC);
+
+    // Relocations we have already generated, keyed by the instrumentation
+    // state of the functions they cover and the global code generation
+    // settings. When instrumentation is toggled
+    // back to a state we have seen before we reinstall the saved code and
+    // springboards instead of running the CodeMover again. The signature
+    // names snippets by address, so each entry holds references to its
+    // snippets to keep those addresses from being reused.
+    typedef std::vector<Address> RelocSignature;
+    struct CachedRelocation {
+       Relocation::CodeTracker *tracker;
+       Address base;
+       std::vector<unsigned char> code;
+       SavedPatches springboards;
+       Relocation::SpringboardBuilder::Traps traps;
+       Relocation::SpringboardBuilder::Branches branches;
+       std::vector<PatchAPI::SnippetPtr> snippets;
+       unsigned long lastUse;
+    };
+    std::map<RelocSignature, CachedRelocation> relocCache_;
+    unsigned long relocCacheClock_;
+    bool getRelocSignature(FuncSet::const_iterator begin, FuncSet::const_iterator end,
+                           RelocSignature &sig, std::vector<PatchAPI::SnippetPtr> &snippets);
+    bool reinstallRelocation(CachedRelocation &cached);
+    void trimRelocCache();
+    // Drops every cached relocation; called when code they cover goes away
+    void clearRelocCache() { relocCache_.clear(); }
+    bool writeInstSwitches(Relocation::CodeTracker *tracker, baseTramp *only);
     Dyninst::Relocation::InstalledSpringboards::Ptr installedSpringboards_;
  public:
     Dyninst::Relocation::InstalledSpringboards::Ptr getInstalledSpringboards() 
@@ -134,6 +134,22 @@ class baseTramp {
 
     bool saveFPRs();
     void setNeedsFrame(bool);
+
+    // Switchable instrumentation: the tramp starts with a single
+    // instruction that is a same-sized NOP while enabled and a branch
+    // over the rest of the tramp while disabled.
+    bool switchable() const { return switchable_; }
+    bool enabled() const { return enabled_; }
+    void setEnabled(bool e) { enabled_ = e; }
+    int switchIndex() const { return switchIndex_; }
+    void setSwitchIndex(int i) { switchIndex_ = i; }
+    unsigned switchSize() const;
+    static void generateSwitch(codeGen &gen, unsigned size, long skip);
+
+ private:
+    bool switchable_;
+    bool enabled_;
+    int switchIndex_;
 };
 
 #define X86_REGS_SAVE_LIMIT 3
@@ -175,6 +175,12 @@ class BinaryEdit : public AddressSpace {
 
    bool replaceTrapHandler();
    bool usedATrap();
+
+   // When set, springboard placement tries padding, dead bytes in relocated
+   // code, and chained short branches before falling back to a trap.
+   void setTrapFreeSpringboards(bool b) { trapFreeSpringboards_ = b; }
+   bool trapFreeSpringboards() const { return trapFreeSpringboards_; }
+   void getTrapSites(std::vector<Address> &sites);
    bool isMultiThreadCapable();
    mapped_object *openResolvedLibraryName(std::string filename, 
                                           std::map<std::string, BinaryEdit*> &allOpened);
@@ -227,6 +233,7 @@ class BinaryEdit : public AddressSpace {
     std::vector<BinaryEdit *> siblings;
     bool multithread_capable_;
     bool writing_;
+    bool trapFreeSpringboards_;
 
     // Symbols that other people (e.g., functions) want us to add
     std::vector<SymtabAPI::Symbol *> newDyninstSyms_;
@@ -86,6 +86,8 @@ class trampTrapMappings {
    void addTrapMapping(Address from, Address to, bool write_to_mutatee = false);
    Address getTrapMapping(Address from);
    bool definesTrapMapping(Address from);
+   // Addresses of the trap instructions themselves, in ascending order
+   void getTrapSites(std::vector<Address> &sites);
    bool needsUpdating();
    void flush();
    void allocateTable();
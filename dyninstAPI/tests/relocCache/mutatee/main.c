@@ -0,0 +1,20 @@
+/* Calls work() forever; the test instruments it and compares how often
+   the instrumentation ran with how often work() did. */
+
+volatile int counter = 0;
+volatile int calls = 0;
+
+__attribute__((noinline)) void leaf(void) {
+   volatile int i;
+   for (i = 0; i < 1000; i++) ;
+}
+
+__attribute__((noinline)) void work(void) {
+   leaf();
+   calls++;
+}
+
+int main(void) {
+   for (;;) work();
+   return 0;
+}
@@ -93,6 +93,19 @@ DLLEXPORT void dyninst_free_lock(dyninst_lock_t *lock);
 DLLEXPORT int dyninst_lock(dyninst_lock_t *lock);
 DLLEXPORT void dyninst_unlock(dyninst_lock_t *lock);
 
+/**
+ * Switchable instrumentation (see BPatch::setSwitchableInstrumentation).
+ *
+ * Each switchable instrumentation point is given an index into the
+ * DYNINST_inst_disabled map, available from the mutator through
+ * BPatch_point::getInstrumentationSwitch().  A nonzero entry suppresses
+ * the snippets at that point; the mutee may toggle it directly.
+ **/
+#define DYNINST_MAX_INST_SWITCHES (64*1024)
+
+DLLEXPORT void DYNINST_set_inst_enabled(int index, int enabled);
+DLLEXPORT int DYNINST_get_inst_enabled(int index);
+
 /**
  * Internal functions that we export to ensure they show up.
  **/
@@ -119,6 +132,7 @@ DLLEXPORT extern int libdyninstAPI_RT_init_localPid;
 DLLEXPORT extern int libdyninstAPI_RT_init_maxthreads;
 DLLEXPORT extern int libdyninstAPI_RT_init_debug_flag;
 DLLEXPORT extern struct DYNINST_bootstrapStruct DYNINST_bootstrap_info;
+DLLEXPORT extern int DYNINST_inst_disabled[DYNINST_MAX_INST_SWITCHES];
 
 #endif
 #endif
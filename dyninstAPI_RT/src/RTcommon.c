@@ -147,6 +147,21 @@ DLLEXPORT void DYNINST_unlock_tramp_guard()
 
 DECLARE_DYNINST_LOCK(DYNINST_trace_lock);
 
+/* Zero-initialized so that every switchable point starts out enabled */
+DLLEXPORT int DYNINST_inst_disabled[DYNINST_MAX_INST_SWITCHES];
+
+DLLEXPORT void DYNINST_set_inst_enabled(int index, int enabled)
+{
+  if (index < 0 || index >= DYNINST_MAX_INST_SWITCHES) return;
+  DYNINST_inst_disabled[index] = !enabled;
+}
+
+DLLEXPORT int DYNINST_get_inst_enabled(int index)
+{
+  if (index < 0 || index >= DYNINST_MAX_INST_SWITCHES) return 0;
+  return !DYNINST_inst_disabled[index];
+}
+
 /**
  * Init the FPU.  We've seen bugs with Linux (e.g., Redhat 6.2 stock kernel on
  * PIIIs) where processes started by Paradyn started with FPU uninitialized.
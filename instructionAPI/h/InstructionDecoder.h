@@ -66,6 +66,8 @@ namespace Dyninst
       /// machine language of the type understood by this %InstructionDecoder.
       /// If the buffer does not contain a valid instruction stream, a null %Instruction pointer
       /// will be returned.  The %Instruction's \c size field will contain the size of the instruction decoded.
+      /// Decoding is shallow: only the length and the %Operation are determined here, and the
+      /// operands are materialized the first time one of the operand-based queries is made.
       Instruction decode();
       /// Decode the instruction at \c buffer, interpreting it as machine language of the type
       /// understood by this %InstructionDecoder.  If the buffer does not contain a valid instruction stream,
@@ -54,6 +54,7 @@ class ParseCallback;
 class ParseCallbackManager;
 class CFGModifier;
 class CodeSource;
+class DecodedInsnCache;
 
 typedef enum {
     PreambleMatching, IdiomMatching
@@ -131,6 +132,9 @@ class CodeObject {
     PARSER_EXPORT CFGFactory * fact() const { return _fact; }
     PARSER_EXPORT bool defensiveMode() { return defensive; }
 
+    // Decoded instructions shared by the analyses built on this object
+    PARSER_EXPORT DecodedInsnCache & insnCache();
+
     PARSER_EXPORT bool isIATcall(Address insn, std::string &calleeName);
 
     // This is for callbacks; it is often much more efficient to 
@@ -0,0 +1,156 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef _DECODED_INSN_CACHE_H_
+#define _DECODED_INSN_CACHE_H_
+
+#include <list>
+#include <stdio.h>
+#include <map>
+#include <utility>
+#include <boost/atomic.hpp>
+#include <boost/unordered_map.hpp>
+
+#include "dyntypes.h"
+#include "concurrent.h"
+#include "Instruction.h"
+#include "InstructionDecoder.h"
+
+namespace Dyninst {
+namespace ParseAPI {
+
+class CodeRegion;
+
+/** A DecodedInsnCache holds the opcode-level decoding of instructions in
+    one CodeObject, keyed by region and address, so that Block and
+    PatchBlock instruction lists, slicing, liveness and stack analysis do
+    not each decode the same bytes again.
+
+    Only the Operation and length of an instruction are kept. Every lookup
+    returns a fresh Instruction built from them, so operand expressions are
+    never shared between callers; they are still materialized lazily by
+    InstructionAPI on first use.
+
+    The cache is filled lazily by lookups, not by the parser, and is
+    split into independently locked shards holding at most capacity()
+    instructions; when a shard is full its least recently used entry is
+    evicted. Ranges are invalidated when their blocks are destroyed or
+    their code bytes are updated.
+**/
+class PARSER_EXPORT DecodedInsnCache {
+ public:
+    static const size_t DEFAULT_CAPACITY = 1 << 14;
+
+    DecodedInsnCache(size_t capacity = DEFAULT_CAPACITY);
+    ~DecodedInsnCache();
+
+    /* The instruction at `addr' in `cr'. On a miss it is decoded with
+       `dec' when one is given, otherwise with a decoder owned by the
+       calling thread. Returns an invalid Instruction if `addr' is not
+       in the region. */
+    InstructionAPI::Instruction get(CodeRegion * cr, Address addr,
+                                    InstructionAPI::InstructionDecoder * dec = NULL);
+
+    /* The same, but decoded as if the code ended at `limit', e.g. the end
+       of the block being walked. */
+    InstructionAPI::Instruction getWithin(CodeRegion * cr, Address addr, Address limit);
+
+    /* Every instruction starting in [start, end), as a Block would list
+       them, decoded without reading past `end'. An instruction that does
+       not decode is listed too unless it has no length, which ends the
+       walk. */
+    void getRange(CodeRegion * cr, Address start, Address end,
+                  std::map<Offset, InstructionAPI::Instruction> & insns);
+
+    /* Record an instruction the caller already decoded, replacing any
+       earlier decoding at that address. */
+    void insert(CodeRegion * cr, Address addr,
+                const InstructionAPI::Instruction & insn);
+
+    /* Forget instructions starting in [start, end), e.g. after the code
+       there has been overwritten. */
+    void invalidate(CodeRegion * cr, Address start, Address end);
+    void clear();
+
+    size_t capacity() const { return capacity_; }
+    void setCapacity(size_t capacity);
+    size_t size() const;
+
+    /* Decode savings: lookups answered without decoding, lookups that
+       decoded, instructions inserted by callers, and evictions. */
+    unsigned long hits() const { return hits_.load(); }
+    unsigned long misses() const { return misses_.load(); }
+    unsigned long inserts() const { return inserts_.load(); }
+    unsigned long evictions() const { return evictions_.load(); }
+    void printStats(FILE * out) const;
+
+ private:
+    typedef std::pair<CodeRegion *, Address> Key;
+
+    struct Entry {
+        Key key;
+        InstructionAPI::Operation op;
+        unsigned char size;
+        Entry(const Key & k, const InstructionAPI::Operation & o, unsigned char s)
+            : key(k), op(o), size(s) {}
+    };
+    typedef std::list<Entry> LRUList;
+
+    struct Shard {
+        dyn_mutex lock;
+        LRUList lru; // most recently used at the front
+        boost::unordered_map<Key, LRUList::iterator> index;
+    };
+
+    static const unsigned NUM_SHARDS = 64;
+
+    Shard & shardFor(const Key & k);
+    bool lookup(const Key & k, const unsigned char * raw,
+                InstructionAPI::Instruction & out);
+    void store(const Key & k, const InstructionAPI::Instruction & insn, bool replace);
+    InstructionAPI::Instruction fetch(CodeRegion * cr, Address addr, Address limit,
+                                      InstructionAPI::InstructionDecoder * dec);
+    InstructionAPI::Instruction decode(CodeRegion * cr, Address addr, Address limit,
+                                       const unsigned char * raw,
+                                       InstructionAPI::InstructionDecoder * dec);
+
+    size_t capacity_;
+    Shard shards_[NUM_SHARDS];
+
+    boost::atomic<unsigned long> hits_;
+    boost::atomic<unsigned long> misses_;
+    boost::atomic<unsigned long> inserts_;
+    boost::atomic<unsigned long> evictions_;
+};
+
+}
+}
+
+#endif
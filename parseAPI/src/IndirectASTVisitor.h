@@ -22,18 +22,6 @@ using namespace Dyninst::DataflowAPI;
 #define SIGNEX_32_8 0xffffff00
 
 
-
-class SimplifyVisitor: public ASTVisitor {
-    Address addr;
-    bool keepMultiOne;
-    SymbolicExpression &se;
-public:
-    using ASTVisitor::visit;
-    virtual ASTPtr visit(DataflowAPI::RoseAST *ast);
-    SimplifyVisitor(Address a, bool k, SymbolicExpression &sym): addr(a), keepMultiOne(k), se(sym) {}
-};
-
-
 class BoundCalcVisitor: public ASTVisitor {
      
 public:
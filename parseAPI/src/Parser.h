@@ -48,6 +48,7 @@
 #include "CodeObject.h"
 #include "CFG.h"
 #include "ParseCallback.h"
+#include "DecodedInsnCache.h"
 
 #include "common/src/dthread.h"
 #include <boost/thread/lockable_adapter.hpp>
@@ -100,6 +101,9 @@ namespace Dyninst {
             // PLT, IAT entries
             dyn_hash_map<Address, string> plt_entries;
 
+            // Backs CodeObject::insnCache()
+            DecodedInsnCache insn_cache;
+
     // a sink block for unbound edges
     boost::atomic<Block *> _sink;
 #ifdef ADD_PARSE_FRAME_TIMERS
@@ -149,6 +153,11 @@ namespace Dyninst {
 
             void parse_at(Address addr, bool recursive, FuncSource src);
 
+            // Parse several new function entries in address order, skipping
+            // any already reached by an earlier one, and finalize once
+            void parse_at(CodeRegion *cr, std::vector<Address> const& targets,
+                          bool recursive, FuncSource src);
+
             void parse_edges(vector<ParseWorkElem *> &work_elems);
 
             CFGFactory &factory() const { return _cfgfact; }
@@ -174,12 +183,23 @@ namespace Dyninst {
 
             ParseData *parse_data() { return _parse_data; }
 
+            DecodedInsnCache &insnCache() { return insn_cache; }
+
         private:
             void parse_vanilla();
             void cleanup_frames();
             void parse_gap_heuristic(CodeRegion *cr);
 
-            bool getGapRange(CodeRegion*, Address, Address&, Address&);
+            // Gaps larger than minSize between function extents, or between
+            // whole functions (entry to last extent end) if !byExtent, with
+            // any ranges already scanned without a match skipped
+            void getGaps(CodeRegion *cr, Address minSize, bool byExtent,
+                         std::map<Address, Address> const& scanned,
+                         std::vector< std::pair<Address, Address> > &gaps);
+            void collect_gap_targets(std::vector< std::pair<Address, Address> > const& gaps,
+                                     std::vector<Address> const& found,
+                                     std::map<Address, Address> &scanned,
+                                     std::vector<Address> &targets);
             void probabilistic_gap_parsing(CodeRegion *cr);
             //void parse_sbp();
 
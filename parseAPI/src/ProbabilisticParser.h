@@ -130,6 +130,40 @@ public:
     double getWeight() {return w;}
     const ChildrenType* getChildrenByEntryID(unsigned short entry_id);
     const ChildrenType* getWildCardChildren();
+    const ChildrenByEntryID& getChildren() const { return childrenClusters; }
+};
+
+// An IdiomPrefixTree flattened into arrays. Each state's edges are
+// contiguous and sorted by entry ID, so matching an instruction is a
+// binary search rather than a hash lookup per tree node.
+class IdiomAutomaton {
+public:
+    struct Edge {
+        IdiomTerm term;
+        unsigned target;
+    };
+    struct State {
+        double w;
+        bool feature;
+        // [edgeBegin, wildBegin) are sorted by entry ID;
+        // [wildBegin, edgeEnd) are wildcard terms
+        unsigned edgeBegin, wildBegin, edgeEnd;
+        bool isLeaf() const { return edgeBegin == edgeEnd; }
+    };
+    typedef std::pair<const Edge*, const Edge*> EdgeRange;
+    static const unsigned root = 0;
+
+    void compile(IdiomPrefixTree *tree);
+    unsigned numStates() const { return states.size(); }
+    const State &state(unsigned s) const { return states[s]; }
+    // Edges out of s whose term has the given entry ID
+    EdgeRange edgesFor(unsigned s, unsigned short entry_id) const;
+    EdgeRange wildcardEdges(unsigned s) const;
+
+private:
+    unsigned addState(IdiomPrefixTree *tree);
+    std::vector<State> states;
+    std::vector<Edge> edges;
 };
 
 class IdiomModel {
@@ -161,6 +195,8 @@ class ProbabilityCalculator {
     };
 
     IdiomModel model;
+    IdiomAutomaton normalIdioms;
+    IdiomAutomaton prefixIdioms;
     CodeRegion* cr;
     CodeSource* cs;
     Parser* parser;
@@ -176,9 +212,9 @@ class ProbabilityCalculator {
     DecodeCache decodeCache;
 
     // Recursively mathcing normal idioms and calculate weights
-    double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid);
+    double calcForwardWeights(int cur, Address addr, unsigned state, bool &valid);
     // Recursively mathcing prefix idioms and calculate weights
-    double calcBackwardWeights(int cur, Address addr, IdiomPrefixTree *tree, std::set<IdiomPrefixTree*> &matched);
+    double calcBackwardWeights(int cur, Address addr, unsigned state, std::vector<bool> &matched);
     // Enforce the overlapping constraints and
     // return true if the cur_addr doesn't conflict with other identified functions,
     // otherwise return false
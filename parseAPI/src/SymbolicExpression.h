@@ -5,6 +5,9 @@
 #include "Absloc.h"
 #include "CodeSource.h"
 #include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 using Dyninst::AST;
 using namespace Dyninst;
 // This class tracks the expanded assignments,
@@ -13,10 +16,21 @@ class SymbolicExpression {
 
     dyn_hash_map<Assignment::Ptr, AST::Ptr, Assignment::AssignmentPtrHasher> expandCache;
 
+    // Hash-consing table for the ASTs built during the analysis.
+    // Interned trees are never modified in place, so structurally equal
+    // subtrees share one node and simplification can be memoized per node.
+    std::unordered_multimap<size_t, AST::Ptr> internTable;
+    std::unordered_set<AST*> interned;
+    std::map<std::tuple<AST*, Address, bool>, AST::Ptr> simplifyCache;
+
+    AST::Ptr SimplifyInterned(AST::Ptr ast, Address addr, bool keepMultiOne);
+
 public:
 
     AST::Ptr SimplifyRoot(AST::Ptr ast, Address addr, bool keepMultiOne = false);
     AST::Ptr SimplifyAnAST(AST::Ptr ast, Address addr, bool keepMultiOne = false);
+    // Returns the shared node structurally equal to ast
+    AST::Ptr Intern(AST::Ptr ast);
     static AST::Ptr SubstituteAnAST(AST::Ptr ast, const std::map<AST::Ptr, AST::Ptr>& aliasMap);
     static AST::Ptr DeepCopyAnAST(AST::Ptr ast);
     static bool ContainAnAST(AST::Ptr root, AST::Ptr check);
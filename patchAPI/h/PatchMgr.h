@@ -78,6 +78,7 @@ class PATCHAPI_EXPORT PatchMgr : public boost::enable_shared_from_this<PatchMgr>
   typedef std::vector<Point::Type> EnumeratedTypes;
 
   public:
+  typedef std::vector<Point *> Points;
   typedef boost::shared_ptr<PatchMgr> Ptr;
   typedef std::pair<Location, Point::Type> Candidate;
   typedef std::vector<Candidate> Candidates;
@@ -144,6 +145,17 @@ class PATCHAPI_EXPORT PatchMgr : public boost::enable_shared_from_this<PatchMgr>
                     OutputIterator output_iter,
                     bool create = true);
 
+    // Bulk interface: find every Point of the given types in an entire
+    // PatchObject, equivalent to findPoints over a Scope covering obj.
+    // Instruction decoding for large objects is done in parallel; Points
+    // are then created serially since PointMaker and PatchCallback are
+    // not required to be thread-safe. Results are
+    // appended to points in a deterministic order.
+    bool findAllPoints(PatchObject *obj,
+                       Point::Type types,
+                       Points &points,
+                       bool create = true);
+
     // Snippet instance removal
     // Return false if no point if found
     bool removeSnippet(InstancePtr);
@@ -227,6 +239,8 @@ class PATCHAPI_EXPORT PatchMgr : public boost::enable_shared_from_this<PatchMgr>
     //bool getEdgeInstances(Scope &scope, EdgeCandidates &edges);
     void getInsnInstances(Scope &scope, InsnInstances &insns);
 
+    void getInsnsParallel(Blocks &blocks, Insns &insns);
+
     void enumerateTypes(Point::Type types, EnumeratedTypes &out);
 
     bool match(Point *, Location *);
@@ -95,13 +95,36 @@ class int_remoteIO;
 class int_memStats;
 class int_memUsage;
 
+struct bp_install_cluster;
+
 struct bp_install_state {
+   bp_install_state() : addr(0), bp(NULL), ibp(NULL), do_install(false), cluster(NULL) {}
    Dyninst::Address addr;
    int_breakpoint *bp;
    sw_breakpoint *ibp;
    bool do_install;
    mem_response::ptr mem_resp;
    result_response::ptr res_resp;
+   bp_install_cluster *cluster;
+};
+
+/**
+ * When many breakpoints are installed at once, breakpoints that sit close
+ * together in one process are grouped into a cluster.  The original bytes
+ * under the whole cluster are read with one memory read, and the trap
+ * bytes for every member are written back with one memory write.
+ **/
+#define BP_CLUSTER_MAX_GAP 64
+#define BP_CLUSTER_MAX_SIZE 4096
+struct bp_install_cluster {
+   int_process *proc;
+   Dyninst::Address start;
+   unsigned long size;
+   std::vector<char> orig;
+   std::vector<char> patched;
+   std::vector<bp_install_state *> members;
+   mem_response::ptr mem_resp;
+   result_response::ptr res_resp;
 };
 
 /**
@@ -125,10 +148,27 @@ class mem_state
    void addLibrary(int_library *lib);
    void rmLibrary(int_library *lib);
 
+   //Breakpoint hit handling looks up the same few addresses over and
+   // over, so lookups go through a small direct-mapped cache in front of
+   // the breakpoints map.  Updates to the map should go through these.
+   sw_breakpoint *findBreakpoint(Dyninst::Address addr);
+   void addBreakpoint(Dyninst::Address addr, sw_breakpoint *bp);
+   void rmBreakpoint(Dyninst::Address addr);
+
    std::set<int_process *> procs;
    std::set<int_library *> libs;
    std::map<Dyninst::Address, sw_breakpoint *> breakpoints;
    std::map<Dyninst::Address, unsigned long> inf_malloced_memory;
+
+  private:
+#define BP_HIT_CACHE_SIZE 64
+   struct bp_cache_entry {
+      Dyninst::Address addr;
+      sw_breakpoint *bp;
+   };
+   bp_cache_entry bp_cache[BP_HIT_CACHE_SIZE];
+   void clearBreakpointCache();
+   static unsigned bpCacheSlot(Dyninst::Address addr);
 };
 
 /**
@@ -386,7 +426,8 @@ class int_process
    HandlerPool *handlerPool() const;
 
    bool addBreakpoint(Dyninst::Address addr, int_breakpoint *bp);
-   bool addBreakpoint_phase1(bp_install_state *is);
+   bool addBreakpoint_phase1(bp_install_state *is, bool defer_prep = false);
+   bool addBreakpoint_prep(bp_install_state *is);
    bool addBreakpoint_phase2(bp_install_state *is);
    bool addBreakpoint_phase3(bp_install_state *is);
 
@@ -1416,6 +1457,11 @@ class sw_breakpoint : public bp_instance
    //Use these three functions to add a breakpoint
    bool prepBreakpoint(int_process *proc, mem_response::ptr mem_resp);
    bool insertBreakpoint(int_process *proc, result_response::ptr res_resp);
+   //Variants for clustered installs: take the original bytes from, and
+   // place the trap bytes into, a local copy of the cluster's memory.
+   bool prepBreakpoint(int_process *proc, const char *orig);
+   bool insertBreakpoint(int_process *proc, char *local);
+   unsigned installSize(int_process *proc) const;
    bool addToIntBreakpoint(int_breakpoint *bp, int_process *proc);
 
    virtual async_ret_t uninstall(int_process *proc, std::set<response::ptr> &resps);
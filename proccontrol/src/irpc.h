@@ -69,7 +69,8 @@ class iRPCAllocation
 	  // HACK: affirmatively set that we do need a data save. If we've just allocated space, why save the data?
       needs_datasave(false),
       have_saved_regs(false),
-      ref_count(0)
+      ref_count(0),
+      batch_used(0)
       {
       }
       ~iRPCAllocation() 
@@ -86,6 +87,13 @@ class iRPCAllocation
    bool have_saved_regs;
    int ref_count;
 
+   //User iRPCs sharing this allocation are laid out back to back rather
+   // than on top of each other, so their code can be written in one go.
+   // This is the number of bytes handed out so far.
+   unsigned long batch_used;
+   bool hasBatchRoom(unsigned long size) const;
+   unsigned long reserveBatchSpace(unsigned long size);
+
    //These are NULL if the user handed us memory to run the iRPC in.
    boost::weak_ptr<int_iRPC> creation_irpc;
    boost::weak_ptr<int_iRPC> deletion_irpc;
@@ -148,6 +156,8 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
 
    unsigned long allocSize() const;
    Dyninst::Address addr() const;
+   Dyninst::Address codeAddr() const;
+   unsigned long batchOffset() const;
    bool hasSavedRegs() const;
    bool userAllocated() const;
    bool shouldSaveData() const;
@@ -177,6 +187,7 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setAllocation(iRPCAllocation::ptr i);
    void setTargetAllocation(iRPCAllocation::ptr i);
    void setAllocSize(unsigned long size);
+   void setBatchOffset(unsigned long o);
    void setShouldSaveData(bool b);
    bool fillInAllocation();
    bool countedSync();
@@ -205,6 +216,9 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void *binary_blob;
    unsigned long binary_size;
    unsigned long start_offset;
+   unsigned long batch_offset;
+   bool code_written;
+   void *batch_buffer;
    int_thread *thrd;
    Address inffree_target;
    iRPCAllocation::ptr cur_allocation;
@@ -80,6 +80,9 @@ public:
    int error;
    pid_t child_pid;
    int event_ext;
+   //A seized tracee's PTRACE_EVENT_STOP for a group-stop; status holds
+   // the stop signal.
+   bool group_stop;
    bool findPairedEvent(ArchEventLinux* &parent, ArchEventLinux* &child);
    void postponePairedEvent();
 
@@ -149,6 +152,12 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool allowSignal(int signal_no);
 
    bool readStatM(unsigned long &stk, unsigned long &heap, unsigned long &shrd);
+
+   // True if this process was attached with PTRACE_SEIZE, in which case its
+   // threads are stopped with PTRACE_INTERRUPT rather than SIGSTOP.
+   bool isSeized() const { return seized; }
+   static bool useSeize();
+   static void disableSeize();
    virtual bool plat_getStackUsage(MemUsageResp_t *resp);
    virtual bool plat_getHeapUsage(MemUsageResp_t *resp);
    virtual bool plat_getSharedUsage(MemUsageResp_t *resp);
@@ -158,6 +167,7 @@ class linux_process : public sysv_process, public unix_process, public thread_db
 
   protected:
    int computeAddrWidth();
+   bool seized;
 };
 
 class linux_x86_process : public linux_process, public x86_process
@@ -225,6 +235,7 @@ class linux_thread : virtual public thread_db_thread
    virtual bool plat_handle_ghost_thread();
    void setOptions();
    bool unsetOptions();
+   static long getPtraceOptions(int_process *proc);
    bool getSegmentBase(Dyninst::MachRegister reg, Dyninst::MachRegisterVal &val);
 
    void postponeSyscallEvent(ArchEventLinux *event);
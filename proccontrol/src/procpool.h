@@ -30,8 +30,6 @@
 #if !defined(PROCPOOL_H_)
 #define PROCPOOL_H_
 
-#include <set>
-#include <map>
 #include "dyntypes.h"
 #include "common/src/dthread.h"
 
@@ -44,9 +42,13 @@ class ProcessPool
 {
    friend ProcessPool *ProcPool();
  protected:
-   std::set<Dyninst::LWP> deadThreads;
-   std::map<Dyninst::PID, int_process *> procs;
-   std::map<Dyninst::LWP, int_thread *> lwps;
+   // Every generated event is routed through these lookups, so keep them
+   // constant time for debuggers that manage hundreds of processes.
+   typedef dyn_hash_map<Dyninst::PID, int_process *> proc_map_t;
+   typedef dyn_hash_map<Dyninst::LWP, int_thread *> lwp_map_t;
+   dyn_hash_set<Dyninst::LWP> deadThreads;
+   proc_map_t procs;
+   lwp_map_t lwps;
    ProcessPool();
    CondVar<> var;
  public:
@@ -0,0 +1,20 @@
+/* Prints the address of its counter, then either spins incrementing it
+   ("spin") or increments it between sleeps ("sleep"), so that the test
+   can attach while it is running or blocked in a system call. */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+volatile unsigned long counter = 0;
+
+int main(int argc, char *argv[]) {
+   int sleeping = (argc > 1 && !strcmp(argv[1], "sleep"));
+   printf("%p\n", (void *) &counter);
+   fflush(stdout);
+   for (;;) {
+      counter++;
+      if (sleeping) usleep(1000);
+   }
+   return 0;
+}
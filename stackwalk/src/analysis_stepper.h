@@ -74,7 +74,6 @@ class AnalysisStepperImpl : public FrameStepper
    
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
-   static std::map<std::string, SymReader*> readers;
    
    static ParseAPI::CodeObject *getCodeObject(std::string name);
    static ParseAPI::CodeSource *getCodeSource(std::string name);
@@ -35,7 +35,10 @@
 #include "common/h/SymReader.h"
 #include "stackwalk/h/procstate.h"
 #include "common/src/addrtranslate.h"
+#include "common/h/concurrent.h"
 #include <set>
+#include <map>
+#include <vector>
 
 namespace Dyninst {
 namespace Stackwalker {
@@ -91,13 +94,52 @@ class StaticBinaryLibState : public LibraryState {
 
 SymbolReaderFactory *getDefaultSymbolReader();
 
+/**
+ * Process-wide cache of SymReaders shared by every Walker and stepper.
+ * Files are keyed by path, and paths whose objects carry the same build-id
+ * (e.g. one library seen through several mount namespaces) share a single
+ * reader.
+ *
+ * getLibrary and registerLibrary pin the reader for the life of the
+ * process. openLibrary hands out a counted reference that must be returned
+ * with closeLibrary; readers that are neither pinned nor referenced are
+ * closed, least recently used first, once the cache exceeds its memory
+ * budget (DYNINST_STACKWALK_CACHE_MB, or setMemoryBudget).
+ **/
 class LibraryWrapper {
   private:
-   std::map<std::string, SymReader *> file_map;
+   struct LibEntry {
+      SymReader *reader;
+      std::string build_id;
+      unsigned long size;
+      unsigned long last_use;
+      unsigned refs;
+      bool pinned;
+      bool registered;
+      std::vector<std::string> names;
+   };
+
+   dyn_mutex lock;
+   std::map<std::string, LibEntry *> file_map;
+   std::map<std::string, LibEntry *> build_id_map;
+   std::map<SymReader *, LibEntry *> reader_map;
+   unsigned long memory_budget;
+   unsigned long cached_size;
+   unsigned long use_clock;
+
+   LibEntry *findOrOpen(std::string filename);
+   void evict();
+   void removeEntry(LibEntry *entry);
   public:
+   LibraryWrapper();
+
    static SymReader *testLibrary(std::string filename);
    static SymReader *getLibrary(std::string filename);
    static void registerLibrary(SymReader *reader, std::string filename);
+
+   static SymReader *openLibrary(std::string filename);
+   static void closeLibrary(SymReader *reader);
+   static void setMemoryBudget(unsigned long bytes);
 };
 
 }
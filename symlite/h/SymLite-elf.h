@@ -62,11 +62,26 @@ class SYMLITE_EXPORT SymElf : public Dyninst::SymReader
    SymCacheEntry *cache;
    unsigned cache_size;
 
+   // Symbol addresses in Eytzinger (1-based BFS) order, and for each slot
+   // the index of the matching entry in the sorted cache. Either malloc'd
+   // or pointing into cache_map.
+   Dyninst::Offset *cache_keys;
+   unsigned *cache_rank;
+   void *cache_map;
+   unsigned long cache_map_size;
+
    Elf_X_Shdr *sym_sections;
    unsigned sym_sections_size;
    
    void createSymCache();
+   void buildSymCacheIndex();
    Symbol_t lookupCachedSymbol(Dyninst::Offset offset);
+   bool findSymLocation(void *symloc, unsigned &sec, unsigned &idx);
+
+   std::string getSymCacheFileName();
+   bool loadSymCacheFile(std::string path, unsigned long total_syms);
+   bool writeSymCacheFile(std::string path, unsigned long total_syms);
+   bool isMappedName(const char *name);
    
    void init();
    unsigned long getSymOffset(const Elf_X_Sym &symbol, unsigned idx);   
@@ -32,7 +32,9 @@
 #define __AddrLookup_H__
 
 #include "Annotatable.h"
+#include "Module.h"
 #include <map>
+#include <vector>
 
 namespace Dyninst {
 
@@ -47,6 +49,25 @@ typedef struct {
    Address dataAddr;
 } LoadedLibrary;
 
+class Function;
+class FunctionBase;
+
+/**
+ * One result of AddressLookup::getSymbols. func is the containing function,
+ * inlined the innermost (possibly inlined) function at the address and lines
+ * its source lines; the latter two are only filled in when requested.
+ **/
+struct SYMTAB_EXPORT SymbolizedAddress {
+   SymbolizedAddress() : addr(0), tab(NULL), offset(0), func(NULL), inlined(NULL) {}
+
+   Address addr;
+   Symtab *tab;
+   Offset offset;
+   Function *func;
+   FunctionBase *inlined;
+   std::vector<Statement::Ptr> lines;
+};
+
 class SYMTAB_EXPORT AddressLookup : public AnnotatableSparse
 {
  private:
@@ -58,6 +79,9 @@ class SYMTAB_EXPORT AddressLookup : public AnnotatableSparse
 
    std::map<Symtab *, LoadedLib *> sym_to_ll;
    std::map<LoadedLib *, Symtab *> ll_to_sym;
+   std::map<Symtab *, std::vector<Function *> > funcs_by_addr;
+
+   std::vector<Function *> *getFuncsVector(Symtab *tab);
 
    LoadedLib *getLoadedLib(Symtab *sym);
    Dyninst::Address symToAddress(LoadedLib *ll, Symbol *sym);
@@ -72,6 +96,15 @@ class SYMTAB_EXPORT AddressLookup : public AnnotatableSparse
 
    bool getSymbol(Address addr, Symbol* &sym, Symtab* &tab, bool close = false);
    bool getOffset(Address addr, Symtab* &tab, Offset &off);
+
+   // Resolves many addresses at once; results[i] describes addrs[i]. The
+   // addresses are sorted and split by library, and each library's slice is
+   // resolved in a single sweep over its functions. Libraries are handled
+   // in parallel when parallel is set. Returns false if no address resolved.
+   bool getSymbols(const std::vector<Address> &addrs,
+                   std::vector<SymbolizedAddress> &results,
+                   bool lines = false, bool inlines = false,
+                   bool parallel = false);
    
    bool getAllSymtabs(std::vector<Symtab *> &tabs);
    bool getLoadAddress(Symtab* sym, Address &load_addr);
@@ -108,6 +108,13 @@ class SYMTAB_EXPORT Archive : public AnnotatableSparse {
        */
       bool parseSymbolTable();      
 
+      /**
+       * Reads the ar global symbol table ("/" or "/SYM64/") straight out
+       * of the mapped archive into membersBySymbol, without creating any
+       * member objects. Returns false if the archive has no such table.
+       */
+      bool readArchiveSymbolIndex();
+
       MappedFile *mf;
 
       //architecture specific data - 
@@ -116,7 +123,8 @@ class SYMTAB_EXPORT Archive : public AnnotatableSparse {
 
       dyn_hash_map<std::string, ArchiveMember *> membersByName;
       dyn_hash_map<Offset, ArchiveMember *> membersByOffset;
-      std::multimap<std::string, ArchiveMember *> membersBySymbol;
+      // Global symbol name -> defining members, in archive order
+      dyn_hash_map<std::string, std::vector<ArchiveMember *> > membersBySymbol;
 
       // The symbol table is lazily parsed
       bool symbolTableParsed;
@@ -285,6 +285,13 @@ namespace Dyninst {
             std::vector<void*> buffers;
             char* allocate_buffer(size_t);
 
+            // Section data that still points at the input object or a Region's
+            // buffer rather than a private copy; libelf writes it straight to
+            // its final offset. Anything modified in place must be made
+            // writable first.
+            std::unordered_set<Elf_Data *> sharedData;
+            void makeDataWritable(Elf_Data *data);
+
         };
         extern template class emitElf<ElfTypes32>;
         extern template class emitElf<ElfTypes64>;